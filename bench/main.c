@@ -0,0 +1,803 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "jerryscript.h"
+#include "jerryscript-ext/bind.h"
+#include "jerryscript-port.h"
+
+/**
+ * Maximum size of a workload or baseline file
+ */
+#define BENCH_BUFFER_SIZE (1048576)
+
+/**
+ * Maximum number of workloads in one run
+ */
+#define BENCH_MAX_WORKLOADS (64)
+
+/**
+ * Default values of the command line options
+ */
+#define BENCH_DEFAULT_RUNS (3)
+#define BENCH_DEFAULT_ITERATIONS (100)
+#define BENCH_DEFAULT_TOLERANCE (10.0)
+
+/**
+ * Bench exit codes
+ */
+#define BENCH_EXIT_CODE_OK         (0)
+#define BENCH_EXIT_CODE_FAIL       (1)
+#define BENCH_EXIT_CODE_REGRESSION (2)
+
+/**
+ * Measurements of a single workload
+ */
+typedef struct
+{
+  char name[64]; /**< workload name, the file name without directory and extension */
+  unsigned long iterations; /**< number of measured bench () calls over all runs */
+  double throughput; /**< bench () calls per second */
+  double latency_mean_us; /**< mean latency of a bench () call */
+  double latency_p50_us; /**< median latency */
+  double latency_p90_us; /**< 90th percentile latency */
+  double latency_p99_us; /**< 99th percentile latency */
+  double latency_max_us; /**< worst latency */
+  double cold_start_us; /**< median time of engine init, parse and top level run */
+  size_t peak_heap_bytes; /**< highest engine heap usage over all runs */
+  long peak_rss_kb; /**< peak resident set size of the process which ran the workload
+                     *   (informational, it is not compared with the baseline) */
+} bench_result_t;
+
+static uint8_t buffer[BENCH_BUFFER_SIZE];
+
+static bench_result_t results[BENCH_MAX_WORKLOADS];
+
+static const uint8_t *
+read_file (const char *file_name, /**< file name */
+           size_t *out_size_p) /**< [out] number of bytes read */
+{
+  FILE *file = fopen (file_name, "r");
+  if (file == NULL)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to open file: %s\n", file_name);
+    return NULL;
+  }
+
+  size_t bytes_read = fread (buffer, 1u, sizeof (buffer), file);
+  if (!bytes_read)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to read file: %s\n", file_name);
+    fclose (file);
+    return NULL;
+  }
+
+  fclose (file);
+
+  *out_size_p = bytes_read;
+  return (const uint8_t *) buffer;
+} /* read_file */
+
+/**
+ * Get a monotonic time stamp
+ *
+ * @return time in microseconds
+ */
+static double
+now_us (void)
+{
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec * 1e6 + (double) ts.tv_nsec / 1e3;
+} /* now_us */
+
+static int
+compare_doubles (const void *a_p, /**< first value */
+                 const void *b_p) /**< second value */
+{
+  double a = *(const double *) a_p;
+  double b = *(const double *) b_p;
+  return (a > b) - (a < b);
+} /* compare_doubles */
+
+/**
+ * Get a percentile of sorted samples
+ *
+ * @return the sample below which the given percent of the samples fall
+ */
+static double
+percentile (const double *sorted_p, /**< sorted samples */
+            size_t count, /**< number of samples */
+            double percent) /**< percentile */
+{
+  size_t index = (size_t) (percent / 100.0 * (double) (count - 1) + 0.5);
+  return sorted_p[index];
+} /* percentile */
+
+/**
+ * Native function which does nothing, used to measure the call overhead
+ */
+static jerry_value_t
+native_noop_handler (const jerry_value_t func_obj_val __attribute__((unused)), /**< function object */
+                     const jerry_value_t this_p __attribute__((unused)), /**< this arg */
+                     const jerry_value_t args_p[] __attribute__((unused)), /**< function arguments */
+                     const jerry_length_t args_cnt __attribute__((unused))) /**< number of function arguments */
+{
+  return jerry_create_undefined ();
+} /* native_noop_handler */
+
+/**
+ * Native function returning the sum of two numbers
+ */
+static jerry_value_t
+native_add_handler (const jerry_value_t func_obj_val __attribute__((unused)), /**< function object */
+                    const jerry_value_t this_p __attribute__((unused)), /**< this arg */
+                    const jerry_value_t args_p[], /**< function arguments */
+                    const jerry_length_t args_cnt) /**< number of function arguments */
+{
+  if (args_cnt < 2 || !jerry_value_is_number (args_p[0]) || !jerry_value_is_number (args_p[1]))
+  {
+    return jerry_create_error (JERRY_ERROR_TYPE, (const jerry_char_t *) "native_add expects two numbers");
+  }
+
+  return jerry_create_number (jerry_get_number_value (args_p[0]) + jerry_get_number_value (args_p[1]));
+} /* native_add_handler */
+
+/**
+ * Native function returning the size of a string, which copies it out of the engine
+ *
+ * Note:
+ *      strings longer than 256 bytes are not copied and their size is reported as 0
+ */
+static jerry_value_t
+native_strlen_handler (const jerry_value_t func_obj_val __attribute__((unused)), /**< function object */
+                       const jerry_value_t this_p __attribute__((unused)), /**< this arg */
+                       const jerry_value_t args_p[], /**< function arguments */
+                       const jerry_length_t args_cnt) /**< number of function arguments */
+{
+  if (args_cnt < 1 || !jerry_value_is_string (args_p[0]))
+  {
+    return jerry_create_error (JERRY_ERROR_TYPE, (const jerry_char_t *) "native_strlen expects a string");
+  }
+
+  jerry_char_t str_buf[256];
+  jerry_size_t size = jerry_string_to_char_buffer (args_p[0], str_buf, sizeof (str_buf));
+  return jerry_create_number ((double) size);
+} /* native_strlen_handler */
+
+static const jerryx_bind_arg_type_t bind_add_args[] =
+{
+  JERRYX_BIND_ARG_NUMBER,
+  JERRYX_BIND_ARG_NUMBER
+};
+
+/**
+ * Same as native_add, bound with jerryscript-ext/bind.h
+ */
+static jerry_value_t
+bind_add (const jerry_value_t this_val __attribute__((unused)), /**< this arg */
+          const jerryx_bind_arg_t args_p[]) /**< native arguments */
+{
+  return jerry_create_number (args_p[0].number + args_p[1].number);
+} /* bind_add */
+
+JERRYX_BIND_HANDLER (bind_add_handler, bind_add, bind_add_args)
+
+static const jerryx_bind_arg_type_t bind_strlen_args[] =
+{
+  JERRYX_BIND_ARG_STRING
+};
+
+/**
+ * Native function returning the size of a string, which reads the borrowed characters
+ */
+static jerry_value_t
+bind_strlen (const jerry_value_t this_val __attribute__((unused)), /**< this arg */
+             const jerryx_bind_arg_t args_p[]) /**< native arguments */
+{
+  return jerry_create_number ((double) args_p[0].string.size);
+} /* bind_strlen */
+
+JERRYX_BIND_HANDLER (bind_strlen_handler, bind_strlen, bind_strlen_args)
+
+/**
+ * Native functions available to the workloads
+ */
+static const jerryx_bind_function_t native_functions[] =
+{
+  JERRYX_BIND_FUNCTION ("native_noop", native_noop_handler),
+  JERRYX_BIND_FUNCTION ("native_add", native_add_handler),
+  JERRYX_BIND_FUNCTION ("native_strlen", native_strlen_handler),
+  JERRYX_BIND_FUNCTION ("bind_add", bind_add_handler),
+  JERRYX_BIND_FUNCTION ("bind_strlen", bind_strlen_handler),
+  JERRYX_BIND_FUNCTION_LIST_END ()
+};
+
+static jerry_value_t
+get_named_property (jerry_value_t obj_val, /**< object */
+                    const char *name_p) /**< property name */
+{
+  jerry_value_t name_val = jerry_create_string ((const jerry_char_t *) name_p);
+  jerry_value_t prop_val = jerry_get_property (obj_val, name_val);
+  jerry_release_value (name_val);
+  return prop_val;
+} /* get_named_property */
+
+/**
+ * Get a numeric property of an object
+ *
+ * @return the value of the property, or 'default_value' if it is not a number
+ */
+static double
+get_number_property (jerry_value_t obj_val, /**< object */
+                     const char *name_p, /**< property name */
+                     double default_value) /**< value used when the property is missing */
+{
+  jerry_value_t prop_val = get_named_property (obj_val, name_p);
+
+  if (jerry_value_is_number (prop_val))
+  {
+    default_value = jerry_get_number_value (prop_val);
+  }
+
+  jerry_release_value (prop_val);
+  return default_value;
+} /* get_number_property */
+
+static void
+set_workload_name (bench_result_t *result_p, /**< [out] result */
+                   const char *file_name) /**< workload file name */
+{
+  const char *base_p = strrchr (file_name, '/');
+  base_p = (base_p != NULL) ? base_p + 1 : file_name;
+
+  size_t length = strlen (base_p);
+  const char *ext_p = strrchr (base_p, '.');
+
+  if (ext_p != NULL)
+  {
+    length = (size_t) (ext_p - base_p);
+  }
+
+  if (length >= sizeof (result_p->name))
+  {
+    length = sizeof (result_p->name) - 1;
+  }
+
+  memcpy (result_p->name, base_p, length);
+  result_p->name[length] = '\0';
+} /* set_workload_name */
+
+/**
+ * Run a workload
+ *
+ * Every run starts a fresh engine, runs the top level code of the workload, which must define
+ * a global 'bench' function, and calls it 'bench_iterations' times (a global of the workload,
+ * or the command line default) after a short warm-up.
+ *
+ * @return true - if the workload ran without errors,
+ *         false - otherwise
+ */
+static bool
+run_workload (const char *file_name, /**< workload file name */
+              unsigned long runs, /**< number of fresh engine runs */
+              unsigned long default_iterations, /**< iterations per run, if the workload does not set it */
+              bench_result_t *result_p) /**< [out] measurements */
+{
+  size_t source_size;
+  const jerry_char_t *source_p = read_file (file_name, &source_size);
+
+  if (source_p == NULL)
+  {
+    return false;
+  }
+
+  memset (result_p, 0, sizeof (bench_result_t));
+  set_workload_name (result_p, file_name);
+
+  if (runs > SIZE_MAX / sizeof (double))
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: too many runs: %lu\n", runs);
+    return false;
+  }
+
+  double *cold_start_samples_p = (double *) malloc (sizeof (double) * runs);
+  double *latency_samples_p = NULL;
+  size_t latency_count = 0;
+  double measured_us = 0;
+  bool is_ok = (cold_start_samples_p != NULL);
+
+  if (!is_ok)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: not enough memory for %lu runs\n", runs);
+  }
+
+  for (unsigned long run = 0; run < runs && is_ok; run++)
+  {
+    double start_us = now_us ();
+
+    jerry_init (JERRY_INIT_EMPTY);
+
+    jerry_value_t global_obj_val = jerry_get_global_object ();
+    jerry_release_value (jerryx_bind_register_functions (global_obj_val, native_functions));
+
+    jerry_value_t ret_value = jerry_parse (source_p, source_size, false);
+
+    if (!jerry_value_has_error_flag (ret_value))
+    {
+      jerry_value_t func_val = ret_value;
+      ret_value = jerry_run (func_val);
+      jerry_release_value (func_val);
+    }
+
+    cold_start_samples_p[run] = now_us () - start_us;
+
+    jerry_value_t bench_val = get_named_property (global_obj_val, "bench");
+
+    if (jerry_value_has_error_flag (ret_value) || !jerry_value_is_function (bench_val))
+    {
+      jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: %s does not define a bench function\n", file_name);
+      is_ok = false;
+    }
+
+    jerry_release_value (ret_value);
+
+    unsigned long iterations = (unsigned long) get_number_property (global_obj_val,
+                                                                    "bench_iterations",
+                                                                    (double) default_iterations);
+    unsigned long warmup = iterations / 10 + 1;
+
+    if (is_ok && latency_samples_p == NULL)
+    {
+      if (iterations <= SIZE_MAX / sizeof (double) / runs)
+      {
+        latency_samples_p = (double *) malloc (sizeof (double) * runs * iterations);
+      }
+
+      if (latency_samples_p == NULL)
+      {
+        jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: not enough memory for %lu x %lu latency samples\n",
+                        runs, iterations);
+        is_ok = false;
+      }
+    }
+
+    for (unsigned long i = 0; is_ok && i < warmup + iterations; i++)
+    {
+      double call_start_us = now_us ();
+      ret_value = jerry_call_function (bench_val, global_obj_val, NULL, 0);
+      double call_us = now_us () - call_start_us;
+
+      if (jerry_value_has_error_flag (ret_value))
+      {
+        jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: bench function of %s threw an exception\n", file_name);
+        is_ok = false;
+      }
+      else if (i >= warmup && latency_count < runs * iterations)
+      {
+        latency_samples_p[latency_count++] = call_us;
+        measured_us += call_us;
+      }
+
+      jerry_release_value (ret_value);
+    }
+
+    jerry_heap_stats_t stats;
+
+    if (jerry_get_memory_stats (&stats) && stats.peak_allocated_bytes > result_p->peak_heap_bytes)
+    {
+      result_p->peak_heap_bytes = stats.peak_allocated_bytes;
+    }
+
+    jerry_release_value (bench_val);
+    jerry_release_value (global_obj_val);
+    jerry_cleanup ();
+  }
+
+  if (is_ok && latency_count > 0)
+  {
+    qsort (latency_samples_p, latency_count, sizeof (double), compare_doubles);
+    qsort (cold_start_samples_p, runs, sizeof (double), compare_doubles);
+
+    result_p->iterations = latency_count;
+    result_p->throughput = (double) latency_count / (measured_us / 1e6);
+    result_p->latency_mean_us = measured_us / (double) latency_count;
+    result_p->latency_p50_us = percentile (latency_samples_p, latency_count, 50);
+    result_p->latency_p90_us = percentile (latency_samples_p, latency_count, 90);
+    result_p->latency_p99_us = percentile (latency_samples_p, latency_count, 99);
+    result_p->latency_max_us = latency_samples_p[latency_count - 1];
+    result_p->cold_start_us = percentile (cold_start_samples_p, runs, 50);
+  }
+
+  free (latency_samples_p);
+  free (cold_start_samples_p);
+  return is_ok && latency_count > 0;
+} /* run_workload */
+
+/**
+ * Run a workload in a child process, so the peak RSS is measured for this workload alone
+ *
+ * @return true - if the workload ran without errors,
+ *         false - otherwise
+ */
+static bool
+run_workload_in_child (const char *file_name, /**< workload file name */
+                       unsigned long runs, /**< number of fresh engine runs */
+                       unsigned long default_iterations, /**< iterations per run, if the workload does not set it */
+                       bench_result_t *result_p) /**< [out] measurements */
+{
+  int pipe_fds[2];
+
+  if (pipe (pipe_fds) != 0)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to create a pipe\n");
+    return false;
+  }
+
+  fflush (stdout);
+  fflush (stderr);
+
+  pid_t pid = fork ();
+
+  if (pid < 0)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to start a process for %s\n", file_name);
+    close (pipe_fds[0]);
+    close (pipe_fds[1]);
+    return false;
+  }
+
+  if (pid == 0)
+  {
+    close (pipe_fds[0]);
+
+    bool is_ok = (run_workload (file_name, runs, default_iterations, result_p)
+                  && write (pipe_fds[1], result_p, sizeof (bench_result_t)) == (ssize_t) sizeof (bench_result_t));
+
+    close (pipe_fds[1]);
+    _exit (is_ok ? BENCH_EXIT_CODE_OK : BENCH_EXIT_CODE_FAIL);
+  }
+
+  close (pipe_fds[1]);
+  ssize_t bytes_read = read (pipe_fds[0], result_p, sizeof (bench_result_t));
+  close (pipe_fds[0]);
+
+  int status;
+  struct rusage usage;
+
+  if (wait4 (pid, &status, 0, &usage) != pid
+      || !WIFEXITED (status)
+      || WEXITSTATUS (status) != BENCH_EXIT_CODE_OK
+      || bytes_read != (ssize_t) sizeof (bench_result_t))
+  {
+    return false;
+  }
+
+  result_p->peak_rss_kb = usage.ru_maxrss;
+  return true;
+} /* run_workload_in_child */
+
+static void
+print_results (FILE *out_p, /**< output stream */
+               const bench_result_t *results_p, /**< measurements */
+               size_t count, /**< number of workloads */
+               bool is_heap_only) /**< print only the peak heap usage */
+{
+  fprintf (out_p, "{\n  \"workloads\": [\n");
+
+  for (size_t i = 0; i < count; i++)
+  {
+    const bench_result_t *result_p = results_p + i;
+
+    if (is_heap_only)
+    {
+      fprintf (out_p,
+               "    {\n"
+               "      \"name\": \"%s\",\n"
+               "      \"peak_heap_bytes\": %lu\n"
+               "    }%s\n",
+               result_p->name,
+               (unsigned long) result_p->peak_heap_bytes,
+               (i + 1 < count) ? "," : "");
+      continue;
+    }
+
+    fprintf (out_p,
+             "    {\n"
+             "      \"name\": \"%s\",\n"
+             "      \"iterations\": %lu,\n"
+             "      \"throughput\": %.2f,\n"
+             "      \"latency_us\": { \"mean\": %.2f, \"p50\": %.2f, \"p90\": %.2f, \"p99\": %.2f, \"max\": %.2f },\n"
+             "      \"cold_start_us\": %.2f,\n"
+             "      \"peak_heap_bytes\": %lu,\n"
+             "      \"peak_rss_kb\": %ld\n"
+             "    }%s\n",
+             result_p->name,
+             result_p->iterations,
+             result_p->throughput,
+             result_p->latency_mean_us,
+             result_p->latency_p50_us,
+             result_p->latency_p90_us,
+             result_p->latency_p99_us,
+             result_p->latency_max_us,
+             result_p->cold_start_us,
+             (unsigned long) result_p->peak_heap_bytes,
+             result_p->peak_rss_kb,
+             (i + 1 < count) ? "," : "");
+  }
+
+  fprintf (out_p, "  ]\n}\n");
+} /* print_results */
+
+/**
+ * Report a regression if the measured value is worse than the baseline by more than the tolerance
+ *
+ * @return true - if the value regressed,
+ *         false - otherwise
+ */
+static bool
+check_metric (const char *workload_p, /**< workload name */
+              const char *metric_p, /**< metric name */
+              double value, /**< measured value */
+              double baseline, /**< baseline value */
+              bool higher_is_better, /**< direction of the metric */
+              double tolerance) /**< allowed change in percent */
+{
+  if (baseline <= 0)
+  {
+    return false;
+  }
+
+  double change = (value - baseline) / baseline * 100.0;
+
+  if (higher_is_better ? (change >= -tolerance) : (change <= tolerance))
+  {
+    return false;
+  }
+
+  fprintf (stderr, "Regression: %s %s %.2f, baseline %.2f (%+.1f%%)\n", workload_p, metric_p, value, baseline, change);
+  return true;
+} /* check_metric */
+
+/**
+ * Compare the measurements with a baseline file written by an earlier run
+ *
+ * Throughput, median latency and peak heap usage are compared, or only the peak heap usage
+ * with 'is_heap_only', which unlike the timings does not depend on the machine. Workloads
+ * which are missing from the baseline are skipped.
+ *
+ * @return BENCH_EXIT_CODE_OK - if nothing regressed,
+ *         BENCH_EXIT_CODE_REGRESSION - if a metric regressed,
+ *         BENCH_EXIT_CODE_FAIL - if the baseline cannot be read
+ */
+static int
+compare_with_baseline (const char *file_name, /**< baseline file name */
+                       const bench_result_t *results_p, /**< measurements */
+                       size_t count, /**< number of workloads */
+                       double tolerance, /**< allowed change in percent */
+                       bool is_heap_only) /**< compare only the peak heap usage */
+{
+  size_t source_size;
+  const jerry_char_t *source_p = read_file (file_name, &source_size);
+
+  if (source_p == NULL)
+  {
+    return BENCH_EXIT_CODE_FAIL;
+  }
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_value_t global_obj_val = jerry_get_global_object ();
+  jerry_value_t json_val = get_named_property (global_obj_val, "JSON");
+  jerry_value_t parse_val = get_named_property (json_val, "parse");
+  jerry_value_t text_val = jerry_create_string_sz_from_utf8 (source_p, (jerry_size_t) source_size);
+  jerry_value_t baseline_val = jerry_call_function (parse_val, json_val, &text_val, 1);
+  jerry_value_t workloads_val = jerry_create_undefined ();
+
+  int ret_code = BENCH_EXIT_CODE_OK;
+
+  if (!jerry_value_has_error_flag (baseline_val))
+  {
+    workloads_val = get_named_property (baseline_val, "workloads");
+  }
+
+  if (!jerry_value_is_array (workloads_val))
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: %s is not a benchmark result file\n", file_name);
+    ret_code = BENCH_EXIT_CODE_FAIL;
+  }
+
+  uint32_t baseline_count = (ret_code == BENCH_EXIT_CODE_OK) ? jerry_get_array_length (workloads_val) : 0;
+
+  for (size_t i = 0; i < count; i++)
+  {
+    const bench_result_t *result_p = results_p + i;
+    bool is_found = false;
+
+    for (uint32_t j = 0; j < baseline_count && !is_found; j++)
+    {
+      jerry_value_t workload_val = jerry_get_property_by_index (workloads_val, j);
+      jerry_value_t name_val = get_named_property (workload_val, "name");
+      jerry_char_t name_buf[sizeof (result_p->name)];
+      jerry_size_t name_size = 0;
+
+      if (jerry_value_is_string (name_val))
+      {
+        name_size = jerry_string_to_utf8_char_buffer (name_val, name_buf, sizeof (name_buf) - 1);
+      }
+
+      name_buf[name_size] = '\0';
+
+      if (!strcmp ((const char *) name_buf, result_p->name))
+      {
+        is_found = true;
+
+        jerry_value_t latency_val = get_named_property (workload_val, "latency_us");
+        bool is_regressed = false;
+
+        if (!is_heap_only)
+        {
+          is_regressed |= check_metric (result_p->name, "throughput", result_p->throughput,
+                                        get_number_property (workload_val, "throughput", 0), true, tolerance);
+          is_regressed |= check_metric (result_p->name, "latency_us.p50", result_p->latency_p50_us,
+                                        get_number_property (latency_val, "p50", 0), false, tolerance);
+        }
+
+        is_regressed |= check_metric (result_p->name, "peak_heap_bytes", (double) result_p->peak_heap_bytes,
+                                      get_number_property (workload_val, "peak_heap_bytes", 0), false, tolerance);
+
+        if (is_regressed)
+        {
+          ret_code = BENCH_EXIT_CODE_REGRESSION;
+        }
+
+        jerry_release_value (latency_val);
+      }
+
+      jerry_release_value (name_val);
+      jerry_release_value (workload_val);
+    }
+
+    if (!is_found && baseline_count > 0)
+    {
+      fprintf (stderr, "Note: %s has no baseline\n", result_p->name);
+    }
+  }
+
+  jerry_release_value (workloads_val);
+  jerry_release_value (baseline_val);
+  jerry_release_value (text_val);
+  jerry_release_value (parse_val);
+  jerry_release_value (json_val);
+  jerry_release_value (global_obj_val);
+  jerry_cleanup ();
+
+  return ret_code;
+} /* compare_with_baseline */
+
+static void
+print_help (char *name)
+{
+  printf ("Usage: %s [OPTION]... [FILE]...\n"
+          "\n"
+          "Runs each workload FILE and prints the measurements as JSON.\n"
+          "\n"
+          "Options:\n"
+          "  -h, --help\n"
+          "  --runs N              fresh engine runs per workload (default: %d)\n"
+          "  --iterations N        measured bench () calls per run, unless the\n"
+          "                        workload sets bench_iterations (default: %d)\n"
+          "  --output FILE         write the JSON into FILE instead of stdout\n"
+          "  --baseline FILE       compare with an earlier output, exit with %d\n"
+          "                        if a workload regressed\n"
+          "  --tolerance PERCENT   allowed change against the baseline (default: %.0f)\n"
+          "  --heap-only           print and compare only the peak heap, which does\n"
+          "                        not depend on the machine\n"
+          "\n",
+          name,
+          BENCH_DEFAULT_RUNS,
+          BENCH_DEFAULT_ITERATIONS,
+          BENCH_EXIT_CODE_REGRESSION,
+          BENCH_DEFAULT_TOLERANCE);
+} /* print_help */
+
+int
+main (int argc,
+      char **argv)
+{
+  unsigned long runs = BENCH_DEFAULT_RUNS;
+  unsigned long iterations = BENCH_DEFAULT_ITERATIONS;
+  double tolerance = BENCH_DEFAULT_TOLERANCE;
+  const char *output_file_name = NULL;
+  const char *baseline_file_name = NULL;
+  bool is_heap_only = false;
+  const char *file_names[BENCH_MAX_WORKLOADS];
+  size_t files_count = 0;
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp ("-h", argv[i]) || !strcmp ("--help", argv[i]))
+    {
+      print_help (argv[0]);
+      return BENCH_EXIT_CODE_OK;
+    }
+    else if (!strcmp ("--runs", argv[i]) && ++i < argc)
+    {
+      runs = strtoul (argv[i], NULL, 10);
+    }
+    else if (!strcmp ("--iterations", argv[i]) && ++i < argc)
+    {
+      iterations = strtoul (argv[i], NULL, 10);
+    }
+    else if (!strcmp ("--tolerance", argv[i]) && ++i < argc)
+    {
+      tolerance = strtod (argv[i], NULL);
+    }
+    else if (!strcmp ("--heap-only", argv[i]))
+    {
+      is_heap_only = true;
+    }
+    else if (!strcmp ("--output", argv[i]) && ++i < argc)
+    {
+      output_file_name = argv[i];
+    }
+    else if (!strcmp ("--baseline", argv[i]) && ++i < argc)
+    {
+      baseline_file_name = argv[i];
+    }
+    else if (argv[i][0] == '-' || files_count >= BENCH_MAX_WORKLOADS)
+    {
+      jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: invalid argument: %s\n", argv[i]);
+      return BENCH_EXIT_CODE_FAIL;
+    }
+    else
+    {
+      file_names[files_count++] = argv[i];
+    }
+  }
+
+  if (files_count == 0 || runs == 0 || iterations == 0)
+  {
+    print_help (argv[0]);
+    return BENCH_EXIT_CODE_FAIL;
+  }
+
+  for (size_t i = 0; i < files_count; i++)
+  {
+    if (!run_workload_in_child (file_names[i], runs, iterations, results + i))
+    {
+      return BENCH_EXIT_CODE_FAIL;
+    }
+  }
+
+  FILE *out_p = stdout;
+
+  if (output_file_name != NULL)
+  {
+    out_p = fopen (output_file_name, "w");
+
+    if (out_p == NULL)
+    {
+      jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to open file: %s\n", output_file_name);
+      return BENCH_EXIT_CODE_FAIL;
+    }
+  }
+
+  print_results (out_p, results, files_count, is_heap_only);
+
+  if (out_p != stdout)
+  {
+    fclose (out_p);
+  }
+
+  if (baseline_file_name != NULL)
+  {
+    return compare_with_baseline (baseline_file_name, results, files_count, tolerance, is_heap_only);
+  }
+
+  return BENCH_EXIT_CODE_OK;
+} /* main */
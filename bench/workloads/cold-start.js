@@ -0,0 +1,31 @@
+/* Cold start: parse and initialize a module of a typical size. The
+ * harness reports the time of the first run of every workload as
+ * cold_start_us; this workload also measures compiling the module
+ * source again with eval. */
+
+var moduleSource = '';
+
+for (var i = 0; i < 40; i++) {
+  moduleSource += 'function handler' + i + '(request, response) {\n' +
+                  '  var data = { id: request.id, index: ' + i + ', items: [] };\n' +
+                  '  for (var i = 0; i < request.count; i++) { data.items.push(i * ' + i + '); }\n' +
+                  '  if (data.items.length > 10) { response.status = 413; return null; }\n' +
+                  '  response.status = 200;\n' +
+                  '  return JSON.stringify(data);\n' +
+                  '}\n';
+}
+
+moduleSource += 'var routes = { ';
+
+for (var i = 0; i < 40; i++) {
+  moduleSource += (i > 0 ? ', ' : '') + '"/path/' + i + '": handler' + i;
+}
+
+moduleSource += ' };\nroutes["/path/7"]({ id: 1, count: 3 }, {});\n';
+
+var bench_iterations = 100;
+
+function bench() {
+  (0, eval)(moduleSource);
+  return moduleSource.length;
+}
@@ -0,0 +1,29 @@
+/* Short-lived allocations of a request: objects, arrays, closures and
+ * strings which become garbage at the end of each call. */
+
+var retained = [];
+
+var bench_iterations = 100;
+
+function bench() {
+  var count = 0;
+
+  for (var i = 0; i < 200; i++) {
+    var headers = { 'content-type': 'application/json', 'x-request-id': 'id-' + i };
+    var body = [i, i + 1, i + 2, { nested: [i] }];
+    var handler = (function (n) {
+      return function () { return n + body.length; };
+    })(i);
+
+    count += handler() + headers['x-request-id'].length;
+  }
+
+  /* Keep a small, bounded amount of data alive across calls. */
+  retained.push({ count: count });
+
+  if (retained.length > 16) {
+    retained.shift();
+  }
+
+  return count;
+}
@@ -0,0 +1,38 @@
+/* JSON parse and stringify of typical API payloads. */
+
+var user = {
+  id: 1042,
+  name: 'Maria da Silva',
+  email: 'maria@example.com',
+  active: true,
+  roles: ['admin', 'editor'],
+  address: { street: 'Rua das Flores, 123', city: 'Belo Horizonte', zip: '30110-000' },
+  balance: 1234.56
+};
+
+var list = [];
+
+for (var i = 0; i < 20; i++) {
+  list.push({ id: i, title: 'Item number ' + i, price: i * 1.5, tags: ['a', 'b', 'c'], available: i % 2 === 0 });
+}
+
+var userText = JSON.stringify(user);
+var listText = JSON.stringify({ total: list.length, page: 1, items: list });
+
+var bench_iterations = 200;
+
+function bench() {
+  var size = 0;
+
+  for (var i = 0; i < 5; i++) {
+    var request = JSON.parse(userText);
+    request.balance += i;
+    size += JSON.stringify(request).length;
+
+    var page = JSON.parse(listText);
+    page.page = i;
+    size += JSON.stringify(page).length;
+  }
+
+  return size;
+}
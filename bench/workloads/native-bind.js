@@ -0,0 +1,16 @@
+/* Overhead of calling native functions bound with jerryscript-ext/bind.h,
+ * the same calls as native-calls. */
+
+var bench_iterations = 200;
+
+function bench() {
+  var sum = 0;
+
+  for (var i = 0; i < 300; i++) {
+    native_noop();
+    sum = bind_add(sum, i);
+    sum += bind_strlen('request-' + (i & 7));
+  }
+
+  return sum;
+}
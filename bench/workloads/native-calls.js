@@ -0,0 +1,15 @@
+/* Overhead of calling native functions registered by the host. */
+
+var bench_iterations = 200;
+
+function bench() {
+  var sum = 0;
+
+  for (var i = 0; i < 300; i++) {
+    native_noop();
+    sum = native_add(sum, i);
+    sum += native_strlen('request-' + (i & 7));
+  }
+
+  return sum;
+}
@@ -0,0 +1,43 @@
+/* Regular expression validation of request fields. */
+
+var emailPattern = /^[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,}$/;
+var datePattern = /^(\d{4})-(\d{2})-(\d{2})$/;
+var slugPattern = /^[a-z0-9]+(?:-[a-z0-9]+)*$/;
+var phonePattern = /^\+?\d{1,3}[ -]?\(?\d{2,3}\)?[ -]?\d{4,5}-?\d{4}$/;
+
+var inputs = [
+  'maria@example.com', 'not an email', '2017-10-19', '2017/10/19',
+  'hello-world-42', 'Hello World', '+55 (31) 98765-4321', '12345'
+];
+
+var bench_iterations = 200;
+
+function bench() {
+  var valid = 0;
+
+  for (var i = 0; i < 10; i++) {
+    for (var j = 0; j < inputs.length; j++) {
+      var input = inputs[j];
+
+      if (emailPattern.test(input)) {
+        valid++;
+      }
+
+      var date = datePattern.exec(input);
+
+      if (date !== null && date[2] <= '12') {
+        valid++;
+      }
+
+      if (slugPattern.test(input)) {
+        valid++;
+      }
+
+      if (phonePattern.test(input)) {
+        valid++;
+      }
+    }
+  }
+
+  return valid;
+}
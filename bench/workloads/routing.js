@@ -0,0 +1,81 @@
+/* Request routing: match request paths against a route table with
+ * parameters and dispatch to the handler. */
+
+var routes = [];
+
+function addRoute(method, pattern, handler) {
+  routes.push({ method: method, parts: pattern.split('/'), handler: handler });
+}
+
+function match(route, method, parts) {
+  if (route.method !== method || route.parts.length !== parts.length) {
+    return null;
+  }
+
+  var params = {};
+
+  for (var i = 0; i < parts.length; i++) {
+    var part = route.parts[i];
+
+    if (part.charAt(0) === ':') {
+      params[part.substring(1)] = parts[i];
+    } else if (part !== parts[i]) {
+      return null;
+    }
+  }
+
+  return params;
+}
+
+function dispatch(method, url) {
+  var query = url.indexOf('?');
+  var path = query < 0 ? url : url.substring(0, query);
+  var parts = path.split('/');
+
+  for (var i = 0; i < routes.length; i++) {
+    var params = match(routes[i], method, parts);
+
+    if (params !== null) {
+      return routes[i].handler(params);
+    }
+  }
+
+  return 404;
+}
+
+var resources = ['users', 'posts', 'comments', 'tags', 'orders', 'items', 'invoices', 'sessions'];
+
+for (var r = 0; r < resources.length; r++) {
+  var name = resources[r];
+  addRoute('GET', '/api/' + name, function (params) { return 200; });
+  addRoute('POST', '/api/' + name, function (params) { return 201; });
+  addRoute('GET', '/api/' + name + '/:id', function (params) { return params.id.length; });
+  addRoute('PUT', '/api/' + name + '/:id', function (params) { return 204; });
+  addRoute('DELETE', '/api/' + name + '/:id', function (params) { return 204; });
+  addRoute('GET', '/api/' + name + '/:id/history/:version', function (params) { return params.version.length; });
+}
+
+var requests = [
+  ['GET', '/api/users'],
+  ['GET', '/api/users/42'],
+  ['POST', '/api/orders'],
+  ['GET', '/api/sessions/abc123?fields=id,user'],
+  ['PUT', '/api/items/17'],
+  ['DELETE', '/api/tags/9'],
+  ['GET', '/api/invoices/2017/history/3'],
+  ['GET', '/api/unknown/1']
+];
+
+var bench_iterations = 200;
+
+function bench() {
+  var sum = 0;
+
+  for (var i = 0; i < 5; i++) {
+    for (var j = 0; j < requests.length; j++) {
+      sum += dispatch(requests[j][0], requests[j][1]);
+    }
+  }
+
+  return sum;
+}
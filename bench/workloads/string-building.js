@@ -0,0 +1,43 @@
+/* String building: concatenation, array join and template substitution
+ * as used when rendering responses. */
+
+var rows = [];
+
+for (var i = 0; i < 50; i++) {
+  rows.push({ name: 'row' + i, value: i * 3 });
+}
+
+var template = '<li class="{cls}">{name}: {value}</li>';
+
+function render(template, data) {
+  return template.replace(/\{(\w+)\}/g, function (all, key) {
+    return data[key];
+  });
+}
+
+var bench_iterations = 200;
+
+function bench() {
+  var html = '<ul>';
+
+  for (var i = 0; i < rows.length; i++) {
+    html += '<li>' + rows[i].name + ' = ' + rows[i].value + '</li>';
+  }
+
+  html += '</ul>';
+
+  var parts = [];
+
+  for (var i = 0; i < rows.length; i++) {
+    parts.push(rows[i].name, ':', String(rows[i].value));
+  }
+
+  var joined = parts.join(',');
+  var rendered = '';
+
+  for (var i = 0; i < 10; i++) {
+    rendered += render(template, { cls: 'odd', name: rows[i].name, value: rows[i].value });
+  }
+
+  return html.length + joined.length + rendered.length;
+}
@@ -1,6 +1,7 @@
 #include <string.h>
 #include <stdio.h>
 #include "jerryscript.h"
+#include "jerryscript-ext/bind.h"
 
 static jerry_value_t
 print_handler (const jerry_value_t func_obj_val __attribute__((unused)), /**< function object */
@@ -63,44 +64,28 @@ print_handler (const jerry_value_t func_obj_val __attribute__((unused)), /**< fu
 } /* print_handler */
 
 
-static jerry_value_t
-trip_handler (const jerry_value_t func_obj_val __attribute__((unused)), /**< function object */
-               const jerry_value_t this_p __attribute__((unused)), /**< this arg */
-               const jerry_value_t args_p[], /**< function arguments */
-               const jerry_length_t args_cnt) /**< number of function arguments */
-{
-  jerry_size_t req_sz = jerry_get_string_size (args_p[0]);
-  jerry_char_t str_buf_p[req_sz + 1];
-  jerry_string_to_char_buffer (args_p[0], str_buf_p, req_sz);
-  str_buf_p[req_sz] = '\0';
-  printf("never %d (%s)\n", req_sz, str_buf_p);
-  return args_p[0];
-} /* trip_handler */
-
-
-static void
-register_js_function (const char *name_p, /**< name of the function */
-                      jerry_external_handler_t handler_p) /**< function callback */
+static const jerryx_bind_arg_type_t trip_args[] =
 {
-  jerry_value_t global_obj_val = jerry_get_global_object ();
+  JERRYX_BIND_ARG_STRING
+};
 
-  jerry_value_t function_val = jerry_create_external_function (handler_p);
-  jerry_value_t function_name_val = jerry_create_string ((const jerry_char_t *) name_p);
-  jerry_value_t result_val = jerry_set_property (global_obj_val, function_name_val, function_val);
+static jerry_value_t
+trip (const jerry_value_t this_val __attribute__((unused)), /**< this arg */
+      const jerryx_bind_arg_t args_p[]) /**< native arguments */
+{
+  const jerryx_bind_string_t *str_p = &args_p[0].string;
+  printf("never %d (%.*s)\n", (int) str_p->size, (int) str_p->size, (const char *) str_p->chars_p);
+  return jerry_create_string_sz (str_p->chars_p, str_p->size);
+} /* trip */
 
-  jerry_release_value (function_name_val);
-  jerry_release_value (function_val);
-  jerry_release_value (global_obj_val);
+JERRYX_BIND_HANDLER (trip_handler, trip, trip_args)
 
-  if (jerry_value_has_error_flag (result_val))
-  {
-    // jerry_port_log (JERRY_LOG_LEVEL_WARNING, "Warning: failed to register '%s' method.", name_p);
-    printf("Warning: failed to register '%s' method.", name_p);
-    // print_unhandled_exception (result_val);
-  }
-
-  jerry_release_value (result_val);
-} /* register_js_function */
+static const jerryx_bind_function_t global_functions[] =
+{
+  JERRYX_BIND_FUNCTION ("print", print_handler),
+  JERRYX_BIND_FUNCTION ("trip", trip_handler),
+  JERRYX_BIND_FUNCTION_LIST_END ()
+};
 
 int
 main (int argc, char *argv[])
@@ -110,8 +95,16 @@ main (int argc, char *argv[])
 
   jerry_init(JERRY_INIT_EMPTY);
 
-  register_js_function ("print", print_handler);
-  register_js_function ("trip", trip_handler);
+  jerry_value_t global_obj_val = jerry_get_global_object ();
+  jerry_value_t result_val = jerryx_bind_register_functions (global_obj_val, global_functions);
+
+  if (jerry_value_has_error_flag (result_val))
+  {
+    printf("Warning: failed to register the native functions.");
+  }
+
+  jerry_release_value (result_val);
+  jerry_release_value (global_obj_val);
 
   bool ret_value = jerry_eval(script, script_size, false);
 